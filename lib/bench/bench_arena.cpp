@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <lds/low_discr_seq_n.hpp>
+
+static const unsigned base[] = {2, 3, 5, 7, 11, 13, 17, 19};
+
+/**
+ * @brief Construct a sphere_n and draw a few points, nodes on the heap
+ *
+ * @param state
+ */
+static void SphereN_Heap(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto gen = lds::sphere_n(base);
+        auto res = std::vector<double>(gen.size());
+        for (auto i = 0; i != 16; ++i)
+        {
+            gen.fill(res);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+}
+
+BENCHMARK(SphereN_Heap);
+
+//~~~~~~~~~~~~~~~~
+
+/**
+ * @brief Same as SphereN_Heap with nodes and buffer in a monotonic arena
+ *
+ * @param state
+ */
+static void SphereN_Arena(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto buf = lds::arena<2048> {std::pmr::null_memory_resource()};
+        auto gen = lds::sphere_n(base, buf.resource());
+        auto res = std::pmr::vector<double>(gen.size(), buf.resource());
+        for (auto i = 0; i != 16; ++i)
+        {
+            gen.fill(res);
+        }
+        benchmark::DoNotOptimize(res.data());
+    }
+}
+
+BENCHMARK(SphereN_Arena);
+
+BENCHMARK_MAIN();
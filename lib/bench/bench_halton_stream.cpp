@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+#include <lds/halton_stream.hpp>
+#include <random>
+
+static const unsigned base[] = {2, 3, 5, 7};
+
+/**
+ * @brief One point from each of state.range(0) leaped streams per round
+ *
+ * All streams are distinct: the leap 100003 (prime) is at least the stream
+ * count and coprime to the bases.
+ *
+ * @param state
+ */
+static void LeapedStreams(benchmark::State& state)
+{
+    const auto n = unsigned(state.range(0));
+    const auto leap = 100003U;
+    const auto gen = lds::halton_leaped(base, leap);
+    auto streams = std::vector<lds::halton_stream> {};
+    for (auto j = 0U; j != n; ++j)
+    {
+        streams.push_back(gen.stream(j));
+    }
+    double pt[4];
+
+    for (auto _ : state)
+    {
+        for (auto& s : streams)
+        {
+            gen.next(s, pt);
+            benchmark::DoNotOptimize(pt);
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * n);
+}
+
+// Register the function as a benchmark
+BENCHMARK(LeapedStreams)->Arg(1000)->Arg(100000);
+
+//~~~~~~~~~~~~~~~~
+
+/**
+ * @brief One point from each of state.range(0) random-start streams per round
+ *
+ * @param state
+ */
+static void RandomStartStreams(benchmark::State& state)
+{
+    const auto n = unsigned(state.range(0));
+    const auto gen = lds::halton_random_start(base);
+    auto rng = std::mt19937 {5489U};
+    auto streams = std::vector<lds::halton_random_stream> {};
+    for (auto j = 0U; j != n; ++j)
+    {
+        streams.push_back(gen.random_stream(rng));
+    }
+    double pt[4];
+
+    for (auto _ : state)
+    {
+        for (auto& s : streams)
+        {
+            gen.next(s, pt);
+            benchmark::DoNotOptimize(pt);
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * n);
+}
+
+BENCHMARK(RandomStartStreams)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
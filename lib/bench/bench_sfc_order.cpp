@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <lds/low_discr_seq.hpp>
+#include <lds/sfc_order.hpp>
+#include <vector>
+
+/**
+ * @brief Generate n points on S^2 in a row-major batch
+ *
+ * @param n
+ * @return std::vector<double>
+ */
+static auto sphere_batch(size_t n) -> std::vector<double>
+{
+    const unsigned base[] = {2, 3};
+    auto gen = lds::sphere(base);
+    auto pts = std::vector<double>(3 * n);
+    for (auto i = size_t {0}; i != n; ++i)
+    {
+        gen.fill(gsl::span<double>(pts).subspan(3 * i, 3));
+    }
+    return pts;
+}
+
+static void HilbertOrder(benchmark::State& state)
+{
+    const auto pts = sphere_batch(size_t(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lds::hilbert_order(pts, 3, -1., 1.));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(HilbertOrder)->Arg(1 << 10)->Arg(1 << 16);
+
+//~~~~~~~~~~~~~~~~
+
+static void MortonOrder(benchmark::State& state)
+{
+    const auto pts = sphere_batch(size_t(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lds::morton_order(pts, 3, -1., 1.));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(MortonOrder)->Arg(1 << 10)->Arg(1 << 16);
+
+BENCHMARK_MAIN();
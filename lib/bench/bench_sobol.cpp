@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include <lds/low_discr_seq.hpp>
+#include <lds/sobol.hpp>
+#include <vector>
+
+/**
+ * @brief Halton points in state.range(0) dimensions (consecutive primes),
+ *        written into a buffer
+ *
+ * @param state
+ */
+static void HaltonN(benchmark::State& state)
+{
+    const unsigned primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41,
+        43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113,
+        127, 131, 137, 139, 149, 151, 157};
+    auto gen = lds::halton_n(gsl::span<const unsigned>(primes).first(
+        size_t(state.range(0))));
+    auto pt = std::vector<double>(gen.size());
+
+    for (auto _ : state)
+    {
+        gen.fill(pt);
+        benchmark::DoNotOptimize(pt.data());
+    }
+}
+
+BENCHMARK(HaltonN)->Arg(4)->Arg(16)->Arg(37);
+
+//~~~~~~~~~~~~~~~~
+
+/**
+ * @brief Sobol points in state.range(0) dimensions, written into a buffer
+ *
+ * @param state
+ */
+static void Sobol(benchmark::State& state)
+{
+    auto gen = lds::sobol(size_t(state.range(0)));
+    auto pt = std::vector<double>(gen.size());
+
+    for (auto _ : state)
+    {
+        gen.fill(pt);
+        benchmark::DoNotOptimize(pt.data());
+    }
+}
+
+BENCHMARK(Sobol)->Arg(4)->Arg(16)->Arg(37);
+
+BENCHMARK_MAIN();
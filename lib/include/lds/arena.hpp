@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <memory> // import unique_ptr
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace lds
+{
+
+/**
+ * @brief Deleter for objects created by make_pmr_unique
+ *
+ * @tparam T
+ */
+template <typename T>
+struct pmr_deleter
+{
+    std::pmr::memory_resource* _mr;
+
+    auto operator()(T* p) const noexcept -> void
+    {
+        p->~T();
+        this->_mr->deallocate(p, sizeof(T), alignof(T));
+    }
+};
+
+template <typename T>
+using pmr_unique_ptr = std::unique_ptr<T, pmr_deleter<T>>;
+
+
+/**
+ * @brief std::make_unique with storage taken from a memory resource
+ *
+ * @tparam T
+ * @tparam Args
+ * @param mr
+ * @param args
+ * @return pmr_unique_ptr<T>
+ */
+template <typename T, typename... Args>
+auto make_pmr_unique(std::pmr::memory_resource* mr, Args&&... args)
+    -> pmr_unique_ptr<T>
+{
+    auto* mem = mr->allocate(sizeof(T), alignof(T));
+    try
+    {
+        auto* p = ::new (mem) T(std::forward<Args>(args)...);
+        return pmr_unique_ptr<T>(p, pmr_deleter<T> {mr});
+    }
+    catch (...)
+    {
+        mr->deallocate(mem, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+
+/**
+ * @brief Monotonic arena with N bytes of inline storage
+ *
+ * Everything allocated from it is released at once when the arena goes out
+ * of scope. Requests beyond the inline storage go to upstream.
+ *
+ * @tparam N
+ */
+template <std::size_t N>
+class arena
+{
+  private:
+    alignas(std::max_align_t) std::byte _buf[N];
+    std::pmr::monotonic_buffer_resource _mr;
+
+  public:
+    /**
+     * @brief Construct a new arena object
+     *
+     * @param upstream e.g. std::pmr::null_memory_resource() to forbid heap use
+     */
+    explicit arena(std::pmr::memory_resource* upstream =
+                       std::pmr::get_default_resource()) noexcept
+        : _mr(_buf, N, upstream)
+    {
+    }
+
+    arena(const arena&) = delete;
+    auto operator=(const arena&) -> arena& = delete;
+
+    /**
+     * @brief
+     *
+     * @return std::pmr::memory_resource*
+     */
+    auto resource() noexcept -> std::pmr::memory_resource*
+    {
+        return &this->_mr;
+    }
+
+    /**
+     * @brief Release everything allocated so far
+     *
+     */
+    auto release() -> void
+    {
+        this->_mr.release();
+    }
+};
+
+
+} // namespace
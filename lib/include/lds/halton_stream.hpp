@@ -0,0 +1,250 @@
+#pragma once
+
+#include "low_discr_seq.hpp"
+#include <cassert>
+#include <cstdint>
+#include <numeric> // import gcd
+#include <random>
+
+namespace lds
+{
+
+/**
+ * @brief Per-stream state of a Halton stream family
+ *
+ * Only the next sequence index is kept here; the bases and the stride are
+ * shared by the family, so that many streams fit in cache.
+ */
+struct halton_stream
+{
+    std::uint64_t _index {0};
+};
+
+
+/**
+ * @brief Leaped Halton stream family
+ *
+ * Stream j (0 <= j < leap) yields the Halton points with index
+ * k * leap + j + 1 for k = 0, 1, 2, ... The leap must be coprime to every
+ * base, so that each stream is itself low-discrepancy. Taken together, the
+ * first `leap` streams partition the sequence of `halton_n`.
+ *
+ * The 64-bit index gives each stream about 2^64 / leap points, so a leap of
+ * 10^5 or more (one stream per replica) does not wrap in practice.
+ */
+class halton_leaped
+{
+  private:
+    std::vector<unsigned> _base;
+    unsigned _leap;
+
+  public:
+    /**
+     * @brief Construct a new halton leaped object
+     *
+     * @param base sequence base
+     * @param leap stride between two points of a stream
+     */
+    halton_leaped(gsl::span<const unsigned> base, unsigned leap)
+        : _base(base.begin(), base.end())
+        , _leap {leap}
+    {
+        assert(leap != 0);
+        for ([[maybe_unused]] auto&& b : this->_base)
+        {
+            assert(std::gcd(b, leap) == 1);
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_base.size();
+    }
+
+    /**
+     * @brief Create the j-th stream
+     *
+     * @param j stream number
+     * @return halton_stream
+     */
+    auto stream(unsigned j) const noexcept -> halton_stream
+    {
+        assert(j < this->_leap);
+        return halton_stream {j};
+    }
+
+    /**
+     * @brief Write the next point of a stream into out
+     *
+     * @param s stream state
+     * @param out point buffer of size()
+     */
+    auto next(halton_stream& s, gsl::span<double> out) const noexcept -> void
+    {
+        assert(out.size() >= this->_base.size());
+        assert(s._index <= UINT64_MAX - this->_leap);
+        const auto k = s._index + 1;
+        s._index += this->_leap;
+        for (auto i = 0U; i != this->_base.size(); ++i)
+        {
+            out[i] = vdc64(k, this->_base[i]);
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @param s stream state
+     * @return std::vector<double>
+     */
+    auto operator()(halton_stream& s) const -> std::vector<double>
+    {
+        auto res = std::vector<double>(this->_base.size());
+        this->next(s, res);
+        return res;
+    }
+};
+
+
+/**
+ * @brief SplitMix64 finalizer, used to derive per-dimension start indices
+ *
+ * @param x
+ * @return std::uint64_t
+ */
+inline constexpr auto splitmix64(std::uint64_t x) noexcept -> std::uint64_t
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+
+/**
+ * @brief Per-stream state of a random-start Halton stream
+ *
+ * The start index of each dimension is derived from _key on the fly, so the
+ * state stays at 16 bytes whatever the dimension.
+ */
+struct halton_random_stream
+{
+    std::uint64_t _key {0};
+    std::uint64_t _count {0};
+};
+
+
+/**
+ * @brief Random-start Halton stream family (Wang and Hickernell)
+ *
+ * Dimension i of a stream walks vdc(base[i]) from its own pseudo-random
+ * start index in [0, 2^48), drawn independently per dimension from the
+ * stream key. Two streams of n points overlap in one dimension only if their
+ * starts there are less than n apart (probability < 2n / 2^48 per pair); they
+ * give the same, shifted points only if this happens with the same offset in
+ * every dimension (probability < 2n / 2^(48 d) per pair). The start range
+ * leaves 2^64 - 2^48 points per stream before the index overflows.
+ */
+class halton_random_start
+{
+  private:
+    std::vector<unsigned> _base;
+
+  public:
+    /**
+     * @brief Construct a new halton random start object
+     *
+     * @param base sequence base
+     */
+    explicit halton_random_start(gsl::span<const unsigned> base)
+        : _base(base.begin(), base.end())
+    {
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_base.size();
+    }
+
+    /**
+     * @brief Create the stream of a given key, e.g. a replica number
+     *
+     * @param key
+     * @return halton_random_stream
+     */
+    auto stream(std::uint64_t key) const noexcept -> halton_random_stream
+    {
+        return halton_random_stream {key, 0};
+    }
+
+    /**
+     * @brief Create a stream with a random key
+     *
+     * @tparam URBG uniform random bit generator, e.g. std::mt19937
+     * @param gen
+     * @return halton_random_stream
+     */
+    template <typename URBG>
+    auto random_stream(URBG& gen) const -> halton_random_stream
+    {
+        auto dist = std::uniform_int_distribution<std::uint64_t> {};
+        return halton_random_stream {dist(gen), 0};
+    }
+
+    /**
+     * @brief Start index of dimension i of a stream
+     *
+     * @param s stream state
+     * @param i dimension
+     * @return std::uint64_t in [0, 2^48)
+     */
+    auto start(const halton_random_stream& s, size_t i) const noexcept
+        -> std::uint64_t
+    {
+        return splitmix64(s._key + 0x9E3779B97F4A7C15ULL * i) >> 16;
+    }
+
+    /**
+     * @brief Write the next point of a stream into out
+     *
+     * @param s stream state
+     * @param out point buffer of size()
+     */
+    auto next(halton_random_stream& s, gsl::span<double> out) const noexcept
+        -> void
+    {
+        assert(out.size() >= this->_base.size());
+        assert(s._count < UINT64_MAX - (std::uint64_t(1) << 48));
+        s._count += 1;
+        for (auto i = 0U; i != this->_base.size(); ++i)
+        {
+            out[i] = vdc64(this->start(s, i) + s._count, this->_base[i]);
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @param s stream state
+     * @return std::vector<double>
+     */
+    auto operator()(halton_random_stream& s) const -> std::vector<double>
+    {
+        auto res = std::vector<double>(this->_base.size());
+        this->next(s, res);
+        return res;
+    }
+};
+
+
+} // namespace
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm> // import upper_bound
+#include <cassert>
+#include <gsl/span>
+#include <vector>
+
+namespace lds
+{
+
+/**
+ * @brief Evenly spaced numbers over [start, stop], end point included
+ *
+ * @param start
+ * @param stop
+ * @param num number of samples, at least 2
+ * @return std::vector<double>
+ */
+inline auto linspace(double start, double stop, size_t num)
+    -> std::vector<double>
+{
+    assert(num >= 2);
+    const auto step = (stop - start) / double(num - 1);
+    auto res = std::vector<double>(num);
+    for (auto i = size_t {0}; i != num; ++i)
+    {
+        res[i] = start + double(i) * step;
+    }
+    return res;
+}
+
+
+/**
+ * @brief One-dimensional linear interpolation, as numpy.interp
+ *
+ * Values outside [xp[0], xp[n-1]] are clamped to fp[0] and fp[n-1].
+ *
+ * @param x
+ * @param xp increasing sample points
+ * @param fp sample values, same size as xp
+ * @return double
+ */
+inline auto interp(double x, gsl::span<const double> xp,
+    gsl::span<const double> fp) noexcept -> double
+{
+    assert(!xp.empty() && xp.size() == fp.size());
+    const auto n = xp.size();
+    if (!(x > xp[0]))
+    {
+        return fp[0];
+    }
+    if (!(x < xp[n - 1]))
+    {
+        return fp[n - 1];
+    }
+    // xp[i - 1] <= x < xp[i]
+    const auto i =
+        size_t(std::upper_bound(xp.begin(), xp.end(), x) - xp.begin());
+    const auto slope = (fp[i] - fp[i - 1]) / (xp[i] - xp[i - 1]);
+    return fp[i - 1] + slope * (x - xp[i - 1]);
+}
+
+
+} // namespace
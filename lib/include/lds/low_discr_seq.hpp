@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cassert>
 #include <cmath> // import sin, cos, acos, sqrt
+#include <cstdint>
+#include <memory_resource>
+#include <utility> // import move
 #include <vector>
 #include <gsl/span>
 
@@ -11,13 +15,14 @@ static const auto twoPI = 2 * std::acos(-1.);
 
 
 /**
- * @brief van der Corput sequence
+ * @brief van der Corput sequence with a 64-bit index
  *
  * @param k
  * @param base
  * @return double
  */
-inline constexpr auto vdc(unsigned k, unsigned base = 2) noexcept -> double
+inline constexpr auto vdc64(std::uint64_t k, unsigned base = 2) noexcept
+    -> double
 {
     auto vdc = 0.;
     auto denom = 1.;
@@ -26,12 +31,25 @@ inline constexpr auto vdc(unsigned k, unsigned base = 2) noexcept -> double
         denom *= base;
         auto remainder = k % base;
         k /= base;
-        vdc += remainder / denom;
+        vdc += double(remainder) / denom;
     }
     return vdc;
 }
 
 
+/**
+ * @brief van der Corput sequence
+ *
+ * @param k
+ * @param base
+ * @return double
+ */
+inline constexpr auto vdc(unsigned k, unsigned base = 2) noexcept -> double
+{
+    return vdc64(k, base);
+}
+
+
 /**
  * @brief van der Corput sequence generator
  *
@@ -152,6 +170,19 @@ class circle
         return {std::sin(theta), std::cos(theta)};
     }
 
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size 2
+     */
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= 2);
+        const auto theta = this->_vdc() * twoPI; // map to [0, 2*pi];
+        out[0] = std::sin(theta);
+        out[1] = std::cos(theta);
+    }
+
     /**
      * @brief
      *
@@ -199,6 +230,22 @@ class sphere
         return {sinphi * cc[0], sinphi * cc[1], cosphi};
     }
 
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size 3
+     */
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= 3);
+        const auto cosphi = 2 * this->_vdc() - 1; // map to [-1, 1];
+        const auto sinphi = std::sqrt(1 - cosphi * cosphi);
+        this->_cirgen.fill(out);
+        out[0] *= sinphi;
+        out[1] *= sinphi;
+        out[2] = cosphi;
+    }
+
     /**
      * @brief
      *
@@ -277,23 +324,54 @@ class sphere3_hopf
 class halton_n
 {
   private:
-    std::vector<vdcorput> _vec_vdc;
+    std::pmr::vector<vdcorput> _vec_vdc;
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
     /**
      * @brief Construct a new halton n object
      *
-     * @param n
      * @param base
+     * @param alloc
      */
-    halton_n(gsl::span<const unsigned> base)
+    halton_n(gsl::span<const unsigned> base, allocator_type alloc = {})
+        : _vec_vdc(alloc)
     {
+        this->_vec_vdc.reserve(base.size());
         for (auto&& b : base)
         {
             this->_vec_vdc.emplace_back(vdcorput(b));
         }
     }
 
+    halton_n(const halton_n&) = default;
+    halton_n(halton_n&&) = default;
+    auto operator=(const halton_n&) -> halton_n& = default;
+    auto operator=(halton_n&&) -> halton_n& = default;
+
+    /**
+     * @brief Copy other into storage from alloc, e.g. in a std::pmr::vector
+     *
+     * @param other
+     * @param alloc
+     */
+    halton_n(const halton_n& other, allocator_type alloc)
+        : _vec_vdc(other._vec_vdc, alloc)
+    {
+    }
+
+    /**
+     * @brief Move other into storage from alloc; copies if the resources differ
+     *
+     * @param other
+     * @param alloc
+     */
+    halton_n(halton_n&& other, allocator_type alloc)
+        : _vec_vdc(std::move(other._vec_vdc), alloc)
+    {
+    }
+
     /**
      * @brief
      *
@@ -309,6 +387,31 @@ class halton_n
         return res;
     }
 
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size()
+     */
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= this->_vec_vdc.size());
+        auto i = 0U;
+        for (auto& vdc : this->_vec_vdc)
+        {
+            out[i++] = vdc();
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_vec_vdc.size();
+    }
+
     /**
      * @brief
      *
@@ -1,12 +1,167 @@
 #pragma once
 
+#include "arena.hpp"
+#include "interp.hpp"
 #include "low_discr_seq.hpp"
-#include <memory> // import unqiue_ptr
+#include <cassert>
+#include <deque>
+#include <mutex>
+#include <type_traits>
 #include <variant>
 
 namespace lds
 {
 
+static const auto halfPI = 0.5 * std::acos(-1.);
+
+/**
+ * @brief First 1000 prime numbers
+ *
+ * Defined in the precompiled-table TU (lib/src/low_discr_seq_n.cpp); the
+ * generators below are header-only and do not need it.
+ */
+extern const unsigned prime_table[1000];
+
+
+/**
+ * @brief
+ *
+ */
+struct Sp3Table
+{
+    std::vector<double> x {linspace(0., 2 * halfPI, 300)};
+    std::vector<double> t;
+
+    /**
+     * @brief Construct a new Sp 3 Table object
+     *
+     */
+    Sp3Table()
+        : t(x.size())
+    {
+        for (auto i = 0U; i != x.size(); ++i)
+        {
+            t[i] = 0.5 * (x[i] - std::sin(x[i]) * std::cos(x[i]));
+        }
+    }
+};
+
+inline auto getSp3() -> const Sp3Table&
+{
+    static const auto sp3 = Sp3Table {};
+    return sp3;
+}
+
+
+/**
+ * @brief Tables of integral sin^n(x) dx on 300 points of [0, pi]
+ *
+ * Tables up to prebuilt_n are built by the constructor and never change, so
+ * they are read without locking. Larger n are added on demand under a mutex;
+ * they live in deques, so references handed out earlier stay valid.
+ */
+class IntSinPowerTable
+{
+  private:
+    using Vec = std::vector<double>;
+
+  public:
+    static constexpr size_t prebuilt_n = 64;
+
+    const Vec x {linspace(0., 2 * halfPI, 300)};
+
+  private:
+    Vec _neg_cosine;
+    Vec _sine;
+    std::deque<Vec> _vec_tp_even;
+    std::deque<Vec> _vec_tp_odd;
+    std::vector<const Vec*> _prebuilt;
+    std::mutex _mutex;
+
+  public:
+    IntSinPowerTable()
+        : _neg_cosine(x.size())
+        , _sine(x.size())
+    {
+        for (auto i = 0U; i != x.size(); ++i)
+        {
+            this->_neg_cosine[i] = -std::cos(x[i]);
+            this->_sine[i] = std::sin(x[i]);
+        }
+        this->_vec_tp_even.push_back(this->x);
+        this->_vec_tp_odd.push_back(this->_neg_cosine);
+        for (auto n = size_t {0}; n <= prebuilt_n; ++n)
+        {
+            this->_prebuilt.push_back(&this->_get_tp(n));
+        }
+    }
+
+    IntSinPowerTable(const IntSinPowerTable&) = delete;
+    auto operator=(const IntSinPowerTable&) -> IntSinPowerTable& = delete;
+
+    /** Evaluate integral sin^n(x) dx; thread-safe */
+    auto get_tp(size_t n) -> const Vec&
+    {
+        if (n <= prebuilt_n)
+        {
+            return *this->_prebuilt[n];
+        }
+        std::lock_guard<std::mutex> lock(this->_mutex);
+        return this->_get_tp(n);
+    }
+
+  private:
+    auto _get_tp(size_t n) -> const Vec&
+    {
+        auto quot = n / 2;
+        auto rem = n % 2;
+        return rem == 0 ? this->_grow(this->_vec_tp_even, quot, 0.)
+                        : this->_grow(this->_vec_tp_odd, quot, 1.);
+    }
+
+    /** S_n = ((n - 1) S_{n-2} - cos(x) sin^{n-1}(x)) / n, n = 2 quot + rem */
+    auto _grow(std::deque<Vec>& vec_tp, size_t quot, double rem) -> const Vec&
+    {
+        while (vec_tp.size() <= quot)
+        {
+            const auto n = 2. * double(vec_tp.size()) + rem;
+            const auto& Snm2 = vec_tp.back();
+            auto res = Vec(this->x.size());
+            for (auto i = 0U; i != res.size(); ++i)
+            {
+                res[i] = ((n - 1.) * Snm2[i] +
+                             this->_neg_cosine[i] *
+                                 std::pow(this->_sine[i], n - 1.)) /
+                    n;
+            }
+            vec_tp.push_back(std::move(res));
+        }
+        return vec_tp[quot];
+    }
+};
+
+inline auto getSp() -> IntSinPowerTable&
+{
+    static auto sp = IntSinPowerTable {};
+    return sp;
+}
+
+
+/**
+ * @brief Build the interpolation tables of sphere3 and sphere_n
+ *
+ * Otherwise they are built from the global heap on first use. Call this once
+ * at start-up when generators are later constructed from an arena that must
+ * not fall back to the heap; afterwards constructing a sphere3, or a sphere_n
+ * of up to IntSinPowerTable::prebuilt_n dimensions, does not allocate.
+ */
+inline auto init_tables() -> void
+{
+    getSp3();
+    getSp();
+}
+
+
 /** Generate Sphere-3 Halton sequence */
 class sphere3
 {
@@ -31,7 +186,15 @@ class sphere3
      *
      * @return std::vector<double>
      */
-    auto operator()() -> std::vector<double>;
+    auto operator()() -> std::vector<double>
+    {
+        const auto ti = halfPI * this->_vdc(); // map to [0, pi/2];
+        const auto xi = interp(ti, getSp3().t, getSp3().x);
+        const auto cosxi = std::cos(xi);
+        const auto sinxi = std::sin(xi);
+        const auto S = this->_sphere2();
+        return {sinxi * S[0], sinxi * S[1], sinxi * S[2], cosxi};
+    }
 
     constexpr auto reseed(unsigned seed) noexcept -> void
     {
@@ -41,56 +204,430 @@ class sphere3
 };
 
 
-/** Generate using cylindrical coordinate method */
+/**
+ * @brief Generate using cylindrical coordinate method
+ *
+ * The chain of lower-dimensional nodes is allocated from the memory resource
+ * of alloc, so with an arena construction does not touch the global heap.
+ */
 class cylin_n
 {
   private:
     vdcorput _vdc;
-    std::variant<std::unique_ptr<cylin_n>, std::unique_ptr<circle>> _Cgen;
+    size_t _n;
+    std::variant<pmr_unique_ptr<cylin_n>, pmr_unique_ptr<circle>> _Cgen;
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
     /**
      * @brief Construct a new cylin n object
      *
-     * @param n dimension
      * @param base sequence base
+     * @param alloc
      */
-    cylin_n(gsl::span<const unsigned> base);
+    cylin_n(gsl::span<const unsigned> base, allocator_type alloc = {})
+        : _vdc(base[0])
+        , _n(base.size())
+    {
+        auto n = this->_n;
+        assert(n >= 2);
+        if (n == 2)
+        {
+            this->_Cgen = make_pmr_unique<circle>(alloc.resource(), base[1]);
+        }
+        else
+        {
+            this->_Cgen = make_pmr_unique<cylin_n>(
+                alloc.resource(), base.last(n - 1), alloc);
+        }
+    }
+
+    cylin_n(cylin_n&&) = default;
+    auto operator=(cylin_n&&) -> cylin_n& = default;
+
+    /**
+     * @brief Move other into storage from alloc, e.g. in a std::pmr::vector
+     *
+     * If alloc uses another memory resource than other, the node chain is
+     * rebuilt from it, keeping the state of every node.
+     *
+     * @param other
+     * @param alloc
+     */
+    cylin_n(cylin_n&& other, allocator_type alloc)
+        : _vdc(other._vdc)
+        , _n(other._n)
+    {
+        std::visit(
+            [&](auto& t) {
+                using T = typename std::decay_t<decltype(t)>::element_type;
+                if (t.get_deleter()._mr == alloc.resource())
+                {
+                    this->_Cgen = std::move(t);
+                }
+                else if constexpr (std::is_same_v<T, circle>)
+                {
+                    this->_Cgen = make_pmr_unique<T>(alloc.resource(), *t);
+                }
+                else
+                {
+                    this->_Cgen = make_pmr_unique<T>(
+                        alloc.resource(), std::move(*t), alloc);
+                }
+            },
+            other._Cgen);
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_n + 1;
+    }
+
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size()
+     */
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= this->_n + 1);
+        const auto cosphi = 2 * this->_vdc() - 1; // map to [-1, 1];
+        const auto sinphi = std::sqrt(1 - cosphi * cosphi);
+        std::visit([&](auto& t) { t->fill(out); }, this->_Cgen);
+        for (auto i = 0U; i != this->_n; ++i)
+        {
+            out[i] *= sinphi;
+        }
+        out[this->_n] = cosphi;
+    }
 
     /**
      * @brief
      *
      * @return std::vector<double>
      */
-    auto operator()() -> std::vector<double>;
+    auto operator()() -> std::vector<double>
+    {
+        auto res = std::vector<double>(this->_n + 1);
+        this->fill(res);
+        return res;
+    }
+
+    /**
+     * @brief
+     *
+     * @param seed
+     */
+    auto reseed(unsigned seed) noexcept -> void
+    {
+        this->_vdc.reseed(seed);
+        std::visit([&](auto& t) { t->reseed(seed); }, this->_Cgen);
+    }
 };
 
 
-/** Generate Sphere-3 Halton sequence */
+/**
+ * @brief Generate Sphere-n Halton sequence
+ *
+ * Allocator-aware in the same way as cylin_n. The integral sin^n table is
+ * looked up once, at construction; fill() only reads it.
+ */
 class sphere_n
 {
   private:
     vdcorput _vdc;
     size_t _n;
-    std::variant<std::unique_ptr<sphere_n>, std::unique_ptr<sphere>> _Sgen;
+    std::variant<pmr_unique_ptr<sphere_n>, pmr_unique_ptr<sphere>> _Sgen;
+    const std::vector<double>* _tp; // integral sin^n table, stable
     double _range_t;
     double _t0;
 
   public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
     /**
      * @brief Construct a new sphere n object
      *
-     * @param n dimension
      * @param base sequence base
+     * @param alloc
+     */
+    sphere_n(gsl::span<const unsigned> base, allocator_type alloc = {})
+        : _vdc(base[0])
+        , _n(base.size())
+    {
+        auto n = this->_n;
+        assert(n >= 3);
+        if (n == 3)
+        {
+            this->_Sgen =
+                make_pmr_unique<sphere>(alloc.resource(), base.subspan(1, 2));
+        }
+        else
+        {
+            this->_Sgen = make_pmr_unique<sphere_n>(
+                alloc.resource(), base.last(n - 1), alloc);
+        }
+
+        this->_tp = &getSp().get_tp(n);
+        this->_t0 = this->_tp->front();
+        this->_range_t = this->_tp->back() - this->_tp->front();
+    }
+
+    sphere_n(sphere_n&&) = default;
+    auto operator=(sphere_n&&) -> sphere_n& = default;
+
+    /**
+     * @brief Move other into storage from alloc, as cylin_n
+     *
+     * @param other
+     * @param alloc
+     */
+    sphere_n(sphere_n&& other, allocator_type alloc)
+        : _vdc(other._vdc)
+        , _n(other._n)
+        , _tp(other._tp)
+        , _range_t(other._range_t)
+        , _t0(other._t0)
+    {
+        std::visit(
+            [&](auto& t) {
+                using T = typename std::decay_t<decltype(t)>::element_type;
+                if (t.get_deleter()._mr == alloc.resource())
+                {
+                    this->_Sgen = std::move(t);
+                }
+                else if constexpr (std::is_same_v<T, sphere>)
+                {
+                    this->_Sgen = make_pmr_unique<T>(alloc.resource(), *t);
+                }
+                else
+                {
+                    this->_Sgen = make_pmr_unique<T>(
+                        alloc.resource(), std::move(*t), alloc);
+                }
+            },
+            other._Sgen);
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_n + 1;
+    }
+
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size()
      */
-    sphere_n(gsl::span<const unsigned> base);
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= this->_n + 1);
+        const auto vd = this->_vdc();
+        const auto ti = this->_t0 + this->_range_t * vd; // map to [t0, tm-1];
+        const auto xi = interp(ti, *this->_tp, getSp().x);
+        const auto sinphi = std::sin(xi);
+        std::visit([&](auto& t) { t->fill(out); }, this->_Sgen);
+        for (auto i = 0U; i != this->_n; ++i)
+        {
+            out[i] *= sinphi;
+        }
+        out[this->_n] = std::cos(xi);
+    }
 
     /**
      * @brief
      *
      * @return std::vector<double>
      */
-    auto operator()() -> std::vector<double>;
+    auto operator()() -> std::vector<double>
+    {
+        auto res = std::vector<double>(this->_n + 1);
+        this->fill(res);
+        return res;
+    }
+
+    /**
+     * @brief
+     *
+     * @param seed
+     */
+    auto reseed(unsigned seed) noexcept -> void
+    {
+        this->_vdc.reseed(seed);
+        std::visit([&](auto& t) { t->reseed(seed); }, this->_Sgen);
+    }
+};
+
+
+/**
+ * @brief Map a point of [0, 1]^n to S^n in the same way as cylin_n
+ *
+ * @param u point in [0, 1]^n, n >= 2
+ * @param out point buffer of size n + 1
+ */
+inline auto cylin_n_map(gsl::span<const double> u, gsl::span<double> out)
+    noexcept -> void
+{
+    const auto n = u.size();
+    assert(n >= 2 && out.size() >= n + 1);
+    const auto theta = u[n - 1] * twoPI; // map to [0, 2*pi];
+    out[0] = std::sin(theta);
+    out[1] = std::cos(theta);
+    for (auto k = n - 1, m = size_t {2}; k-- != 0; ++m)
+    {
+        const auto cosphi = 2 * u[k] - 1; // map to [-1, 1];
+        const auto sinphi = std::sqrt(1 - cosphi * cosphi);
+        for (auto i = size_t {0}; i != m; ++i)
+        {
+            out[i] *= sinphi;
+        }
+        out[m] = cosphi;
+    }
+}
+
+
+/**
+ * @brief
+ *
+ * @param u point in [0, 1]^n, n >= 2
+ * @return std::vector<double> point in R^(n+1)
+ */
+inline auto cylin_n_map(gsl::span<const double> u) -> std::vector<double>
+{
+    auto res = std::vector<double>(u.size() + 1);
+    cylin_n_map(u, res);
+    return res;
+}
+
+
+namespace detail
+{
+
+/**
+ * @brief sphere_n_map with the table of level m given by tp(m)
+ *
+ * @tparam Tp
+ * @param u point in [0, 1]^n, n >= 2
+ * @param out point buffer of size n + 1
+ * @param tp
+ */
+template <typename Tp>
+inline auto sphere_n_map(gsl::span<const double> u, gsl::span<double> out,
+    Tp&& tp) -> void
+{
+    const auto n = u.size();
+    assert(n >= 2 && out.size() >= n + 1);
+    cylin_n_map(u.last(2), out); // S^2 as in sphere
+    for (auto k = n - 2, m = size_t {3}; k-- != 0; ++m)
+    {
+        const std::vector<double>& t = tp(m);
+        const auto ti = t.front() + (t.back() - t.front()) * u[k];
+        const auto xi = interp(ti, t, getSp().x);
+        const auto sinphi = std::sin(xi);
+        for (auto i = size_t {0}; i != m; ++i)
+        {
+            out[i] *= sinphi;
+        }
+        out[m] = std::cos(xi);
+    }
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Map a point of [0, 1]^n to S^n in the same way as sphere_n
+ *
+ * u[0] plays the role of the first vdcorput of sphere_n, and so on, so any
+ * unit-cube generator (e.g. sobol) can drive the sphere_n pipeline. The
+ * integral sin^n tables are looked up for every level, which takes a lock
+ * above IntSinPowerTable::prebuilt_n dimensions; sphere_n_mapper looks them
+ * up once.
+ *
+ * @param u point in [0, 1]^n, n >= 2
+ * @param out point buffer of size n + 1
+ */
+inline auto sphere_n_map(gsl::span<const double> u, gsl::span<double> out)
+    -> void
+{
+    detail::sphere_n_map(
+        u, out, [](size_t m) -> const auto& { return getSp().get_tp(m); });
+}
+
+
+/**
+ * @brief
+ *
+ * @param u point in [0, 1]^n, n >= 2
+ * @return std::vector<double> point in R^(n+1)
+ */
+inline auto sphere_n_map(gsl::span<const double> u) -> std::vector<double>
+{
+    auto res = std::vector<double>(u.size() + 1);
+    sphere_n_map(u, res);
+    return res;
+}
+
+
+/**
+ * @brief sphere_n_map for points of [0, 1]^n with the tables looked up once
+ *
+ * Use it to map many points of the same dimension, e.g. a sobol batch.
+ */
+class sphere_n_mapper
+{
+  private:
+    std::vector<const std::vector<double>*> _tp; // _tp[m - 3], level m
+
+  public:
+    /**
+     * @brief Construct a new sphere n mapper object
+     *
+     * @param n dimension of the cube, at least 2
+     */
+    explicit sphere_n_mapper(size_t n)
+    {
+        assert(n >= 2);
+        for (auto m = size_t {3}; m <= n; ++m)
+        {
+            this->_tp.push_back(&getSp().get_tp(m));
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of the cube
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_tp.size() + 2;
+    }
+
+    /**
+     * @brief Map u to S^n, as sphere_n_map
+     *
+     * @param u point in [0, 1]^size()
+     * @param out point buffer of size() + 1
+     */
+    auto operator()(gsl::span<const double> u, gsl::span<double> out) const
+        noexcept -> void
+    {
+        assert(u.size() == this->size());
+        detail::sphere_n_map(u, out,
+            [this](size_t m) -> const auto& { return *this->_tp[m - 3]; });
+    }
 };
 
 
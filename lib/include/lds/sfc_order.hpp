@@ -0,0 +1,217 @@
+#pragma once
+
+#include <algorithm> // import sort, min
+#include <cassert>
+#include <cstdint>
+#include <gsl/span>
+#include <utility> // import pair
+#include <vector>
+
+namespace lds
+{
+
+/**
+ * @brief Quantize a point of [lo, hi]^dim to bits per coordinate
+ *
+ * @param pt
+ * @param lo
+ * @param hi
+ * @param bits
+ * @param q output, size of pt
+ */
+inline auto sfc_quantize(gsl::span<const double> pt, double lo, double hi,
+    unsigned bits, gsl::span<std::uint32_t> q) noexcept -> void
+{
+    const auto cells = double(std::uint64_t(1) << bits);
+    const auto qmax = std::uint32_t((std::uint64_t(1) << bits) - 1);
+    for (auto j = 0U; j != pt.size(); ++j)
+    {
+        const auto t = (pt[j] - lo) / (hi - lo) * cells;
+        q[j] = t <= 0. ? 0U
+            : t >= double(qmax) ? qmax
+                                : std::uint32_t(t);
+    }
+}
+
+
+/**
+ * @brief Interleave the bits of q (most significant bit of q[0] first)
+ *
+ * @param q
+ * @param bits
+ * @return std::uint64_t
+ */
+inline auto sfc_interleave(gsl::span<const std::uint32_t> q,
+    unsigned bits) noexcept -> std::uint64_t
+{
+    auto key = std::uint64_t {0};
+    for (auto b = bits; b-- != 0;)
+    {
+        for (auto&& qj : q)
+        {
+            key = (key << 1) | ((qj >> b) & 1U);
+        }
+    }
+    return key;
+}
+
+
+/**
+ * @brief Morton (Z-order) key of a quantized point
+ *
+ * @param q
+ * @param bits
+ * @return std::uint64_t
+ */
+inline auto morton_key(gsl::span<std::uint32_t> q, unsigned bits) noexcept
+    -> std::uint64_t
+{
+    return sfc_interleave(q, bits);
+}
+
+
+/**
+ * @brief Hilbert key of a quantized point (Skilling's transpose algorithm)
+ *
+ * J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+ *
+ * @param q modified in place
+ * @param bits
+ * @return std::uint64_t
+ */
+inline auto hilbert_key(gsl::span<std::uint32_t> q, unsigned bits) noexcept
+    -> std::uint64_t
+{
+    const auto n = q.size();
+    const auto M = std::uint32_t(1) << (bits - 1);
+    // Inverse undo
+    for (auto Q = M; Q > 1; Q >>= 1)
+    {
+        const auto P = Q - 1;
+        for (auto i = 0U; i != n; ++i)
+        {
+            // branch-free form of: if (q[i] & Q) invert low bits of q[0],
+            // else exchange low bits of q[0] and q[i]
+            const auto set = std::uint32_t(0) - std::uint32_t((q[i] & Q) != 0);
+            q[0] ^= P & set;
+            const auto t = (q[0] ^ q[i]) & P & ~set;
+            q[0] ^= t;
+            q[i] ^= t;
+        }
+    }
+    // Gray encode
+    for (auto i = 1U; i < n; ++i)
+    {
+        q[i] ^= q[i - 1];
+    }
+    auto t = std::uint32_t {0};
+    for (auto Q = M; Q > 1; Q >>= 1)
+    {
+        if ((q[n - 1] & Q) != 0)
+        {
+            t ^= Q - 1;
+        }
+    }
+    for (auto i = 0U; i != n; ++i)
+    {
+        q[i] ^= t;
+    }
+    return sfc_interleave(q, bits);
+}
+
+
+/**
+ * @brief Order of a row-major batch of points along a space-filling curve
+ *
+ * Each coordinate gets min(21, 64 / dim) bits; ties keep the original order.
+ *
+ * @tparam Key morton_key or hilbert_key
+ * @param pts row-major batch, pts.size() / dim points
+ * @param dim dimension of a point, 1..64
+ * @param lo
+ * @param hi
+ * @param key
+ * @return std::vector<size_t> perm, where perm[i] is the original index of
+ *         the i-th point along the curve
+ */
+template <typename Key>
+auto sfc_order(gsl::span<const double> pts, size_t dim, double lo, double hi,
+    Key&& key) -> std::vector<size_t>
+{
+    assert(dim >= 1 && dim <= 64);
+    const auto bits = std::min(21U, unsigned(64 / dim));
+    const auto npts = pts.size() / dim;
+    auto q = std::vector<std::uint32_t>(dim);
+    auto keyed = std::vector<std::pair<std::uint64_t, size_t>>(npts);
+    for (auto i = size_t {0}; i != npts; ++i)
+    {
+        sfc_quantize(pts.subspan(i * dim, dim), lo, hi, bits, q);
+        keyed[i] = {key(gsl::span<std::uint32_t>(q), bits), i};
+    }
+    std::sort(keyed.begin(), keyed.end());
+    auto perm = std::vector<size_t>(npts);
+    for (auto i = size_t {0}; i != npts; ++i)
+    {
+        perm[i] = keyed[i].second;
+    }
+    return perm;
+}
+
+
+/**
+ * @brief Morton order of a batch of points in [lo, hi]^dim
+ *
+ * Use lo = -1 for the output of sphere, sphere_n, etc.
+ *
+ * @param pts row-major batch
+ * @param dim dimension of a point
+ * @param lo
+ * @param hi
+ * @return std::vector<size_t>
+ */
+inline auto morton_order(gsl::span<const double> pts, size_t dim,
+    double lo = 0., double hi = 1.) -> std::vector<size_t>
+{
+    return sfc_order(pts, dim, lo, hi, morton_key);
+}
+
+
+/**
+ * @brief Hilbert order of a batch of points in [lo, hi]^dim
+ *
+ * Use lo = -1 for the output of sphere, sphere_n, etc.
+ *
+ * @param pts row-major batch
+ * @param dim dimension of a point
+ * @param lo
+ * @param hi
+ * @return std::vector<size_t>
+ */
+inline auto hilbert_order(gsl::span<const double> pts, size_t dim,
+    double lo = 0., double hi = 1.) -> std::vector<size_t>
+{
+    return sfc_order(pts, dim, lo, hi, hilbert_key);
+}
+
+
+/**
+ * @brief Permute a batch of points: the i-th output point is pts[perm[i]]
+ *
+ * @param pts row-major batch
+ * @param dim dimension of a point
+ * @param perm from morton_order or hilbert_order
+ * @return std::vector<double>
+ */
+inline auto sfc_reorder(gsl::span<const double> pts, size_t dim,
+    gsl::span<const size_t> perm) -> std::vector<double>
+{
+    auto res = std::vector<double>(perm.size() * dim);
+    for (auto i = size_t {0}; i != perm.size(); ++i)
+    {
+        std::copy_n(&pts[perm[i] * dim], dim, &res[i * dim]);
+    }
+    return res;
+}
+
+
+} // namespace
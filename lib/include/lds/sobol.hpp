@@ -0,0 +1,245 @@
+#pragma once
+
+#include "low_discr_seq.hpp"
+#include <algorithm> // import fill
+#include <cassert>
+#include <cstdint>
+#include <iterator> // import size
+
+namespace lds
+{
+
+/**
+ * @brief Primitive polynomial and initial direction numbers of a dimension
+ *
+ * Same layout as one line of the Joe-Kuo direction-number files: degree s,
+ * coefficients a (a_1 as the most significant of s - 1 bits), and m_1..m_s.
+ */
+struct sobol_dir
+{
+    unsigned s;
+    unsigned a;
+    unsigned m[18];
+};
+
+
+/**
+ * @brief Joe-Kuo direction numbers (new-joe-kuo-6.21201) for dimensions 2..37
+ *
+ * These cover all primitive polynomials up to degree 7. Higher dimensions
+ * can be passed to sobol as further lines of the same file.
+ */
+inline constexpr sobol_dir joe_kuo_dir[] = {
+    {1, 0, {1}}, // 2
+    {2, 1, {1, 3}}, // 3
+    {3, 1, {1, 3, 1}}, // 4
+    {3, 2, {1, 1, 1}}, // 5
+    {4, 1, {1, 1, 3, 3}}, // 6
+    {4, 4, {1, 3, 5, 13}}, // 7
+    {5, 2, {1, 1, 5, 5, 17}}, // 8
+    {5, 4, {1, 1, 5, 5, 5}}, // 9
+    {5, 7, {1, 1, 7, 11, 19}}, // 10
+    {5, 11, {1, 1, 5, 1, 1}}, // 11
+    {5, 13, {1, 1, 1, 3, 11}}, // 12
+    {5, 14, {1, 3, 5, 5, 31}}, // 13
+    {6, 1, {1, 3, 3, 9, 7, 49}}, // 14
+    {6, 13, {1, 1, 1, 15, 21, 21}}, // 15
+    {6, 16, {1, 3, 1, 13, 27, 49}}, // 16
+    {6, 19, {1, 1, 1, 15, 7, 5}}, // 17
+    {6, 22, {1, 3, 1, 15, 13, 25}}, // 18
+    {6, 25, {1, 1, 5, 5, 19, 61}}, // 19
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}}, // 20
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}, // 21
+    {7, 7, {1, 1, 3, 13, 7, 35, 63}}, // 22
+    {7, 8, {1, 3, 5, 9, 1, 25, 53}}, // 23
+    {7, 14, {1, 3, 1, 13, 9, 35, 107}}, // 24
+    {7, 19, {1, 3, 1, 5, 27, 61, 31}}, // 25
+    {7, 21, {1, 1, 5, 11, 19, 41, 61}}, // 26
+    {7, 28, {1, 3, 5, 3, 3, 13, 69}}, // 27
+    {7, 31, {1, 1, 7, 13, 1, 19, 1}}, // 28
+    {7, 32, {1, 3, 7, 5, 13, 19, 59}}, // 29
+    {7, 37, {1, 1, 3, 9, 25, 29, 41}}, // 30
+    {7, 41, {1, 3, 5, 13, 23, 1, 55}}, // 31
+    {7, 42, {1, 3, 7, 3, 13, 59, 17}}, // 32
+    {7, 50, {1, 3, 1, 3, 5, 53, 69}}, // 33
+    {7, 55, {1, 1, 5, 5, 23, 33, 13}}, // 34
+    {7, 56, {1, 1, 7, 7, 1, 61, 123}}, // 35
+    {7, 59, {1, 1, 7, 9, 13, 61, 49}}, // 36
+    {7, 62, {1, 3, 3, 5, 3, 55, 33}}, // 37
+};
+
+
+/**
+ * @brief Sobol sequence generator (base 2)
+ *
+ * The index is 32-bit, so the sequence has period 2^32: after point
+ * 2^32 - 1 it continues from point 0, consistent with reseed().
+ *
+ * Points are produced in Gray-code order: each call flips the direction
+ * numbers of the lowest zero bit of the previous index, i.e. O(d) integer
+ * XORs without division. The direction numbers are stored bit-major, so the
+ * update loop runs over contiguous memory.
+ */
+class sobol
+{
+  private:
+    size_t _dim;
+    unsigned _count {0};
+    std::vector<std::uint32_t> _v; // _v[c * _dim + j]: bit c of dimension j
+    std::vector<std::uint32_t> _x;
+
+    static constexpr auto _scale = 1. / 4294967296.; // 2^-32
+
+    static auto _builtin_dir(size_t dim) -> gsl::span<const sobol_dir>
+    {
+        assert(dim >= 1 && dim <= std::size(joe_kuo_dir) + 1);
+        return gsl::span<const sobol_dir>(joe_kuo_dir).first(dim - 1);
+    }
+
+  public:
+    /**
+     * @brief Construct a new sobol object
+     *
+     * @param dirs direction numbers of dimensions 2, 3, ...
+     */
+    explicit sobol(gsl::span<const sobol_dir> dirs)
+        : _dim {dirs.size() + 1}
+        , _v(32 * _dim)
+        , _x(_dim, 0)
+    {
+        for (auto c = 0U; c != 32; ++c)
+        {
+            this->_v[c * this->_dim] = 1U << (31 - c);
+        }
+        for (auto j = 1U; j != this->_dim; ++j)
+        {
+            const auto& d = dirs[j - 1];
+            assert(d.s >= 1 && d.s <= 18);
+            auto v = [&](unsigned c) -> std::uint32_t& {
+                return this->_v[c * this->_dim + j];
+            };
+            for (auto c = 0U; c != 32; ++c)
+            {
+                if (c < d.s)
+                {
+                    v(c) = std::uint32_t(d.m[c]) << (31 - c);
+                    continue;
+                }
+                auto vc = v(c - d.s) ^ (v(c - d.s) >> d.s);
+                for (auto i = 1U; i != d.s; ++i)
+                {
+                    if (((d.a >> (d.s - 1 - i)) & 1U) != 0)
+                    {
+                        vc ^= v(c - i);
+                    }
+                }
+                v(c) = vc;
+            }
+        }
+    }
+
+    /**
+     * @brief Construct a new sobol object with the built-in direction numbers
+     *
+     * @param dim dimension, at most max_dim()
+     */
+    explicit sobol(size_t dim)
+        : sobol(_builtin_dir(dim))
+    {
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t maximum dimension of the built-in direction numbers
+     */
+    static constexpr auto max_dim() noexcept -> size_t
+    {
+        return std::size(joe_kuo_dir) + 1;
+    }
+
+    /**
+     * @brief
+     *
+     * @return size_t dimension of a point
+     */
+    auto size() const noexcept -> size_t
+    {
+        return this->_dim;
+    }
+
+    /**
+     * @brief Write the next point into out
+     *
+     * @param out point buffer of size()
+     */
+    auto fill(gsl::span<double> out) noexcept -> void
+    {
+        assert(out.size() >= this->_dim);
+        this->_count += 1;
+        // Lowest set bit of the index; on wrap-around (_count == 0) bit 31
+        // flips the last point, 2^32 - 1, back to point 0
+        auto c = 0U;
+        for (auto k = this->_count; (k & 1U) == 0 && c != 31; k >>= 1)
+        {
+            ++c;
+        }
+        const auto* vc = &this->_v[c * this->_dim];
+        for (auto j = 0U; j != this->_dim; ++j)
+        {
+            this->_x[j] ^= vc[j];
+            out[j] = double(this->_x[j]) * _scale;
+        }
+    }
+
+    /**
+     * @brief Write out.size() / size() consecutive points into out (row-major)
+     *
+     * @param out
+     */
+    auto batch(gsl::span<double> out) noexcept -> void
+    {
+        for (auto i = size_t {0}; i + this->_dim <= out.size(); i += this->_dim)
+        {
+            this->fill(out.subspan(i, this->_dim));
+        }
+    }
+
+    /**
+     * @brief
+     *
+     * @return std::vector<double>
+     */
+    auto operator()() -> std::vector<double>
+    {
+        auto res = std::vector<double>(this->_dim);
+        this->fill(res);
+        return res;
+    }
+
+    /**
+     * @brief Skip ahead to index seed in O(32 d)
+     *
+     * @param seed
+     */
+    auto reseed(unsigned seed) noexcept -> void
+    {
+        this->_count = seed;
+        const auto gray = seed ^ (seed >> 1);
+        std::fill(this->_x.begin(), this->_x.end(), 0U);
+        for (auto c = 0U; c != 32; ++c)
+        {
+            if (((gray >> c) & 1U) == 0)
+            {
+                continue;
+            }
+            for (auto j = 0U; j != this->_dim; ++j)
+            {
+                this->_x[j] ^= this->_v[c * this->_dim + j];
+            }
+        }
+    }
+};
+
+
+} // namespace
@@ -0,0 +1,40 @@
+#pragma once
+
+// Optional adapter for callers who want xtensor views of generator output.
+// The generators themselves do not depend on xtensor.
+
+#include <array>
+#include <gsl/span>
+#include <vector>
+#include <xtensor/xadapt.hpp>
+
+namespace lds
+{
+
+/**
+ * @brief Non-owning 1-D xtensor view of a point
+ *
+ * @param pt
+ * @return auto
+ */
+inline auto as_xtensor(std::vector<double>& pt)
+{
+    return xt::adapt(pt, std::array<size_t, 1> {pt.size()});
+}
+
+
+/**
+ * @brief Non-owning (n, dim) xtensor view of a row-major batch of points
+ *
+ * @param buf
+ * @param dim dimension of a point
+ * @return auto
+ */
+inline auto as_xtensor(gsl::span<double> buf, size_t dim)
+{
+    return xt::adapt(buf.data(), buf.size(), xt::no_ownership(),
+        std::array<size_t, 2> {buf.size() / dim, dim});
+}
+
+
+} // namespace
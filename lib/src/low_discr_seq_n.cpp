@@ -1,219 +1,8 @@
-#include <cassert>
 #include <lds/low_discr_seq_n.hpp>
-#include <xtensor/xadapt.hpp> // for xtensor
-#include <xtensor/xarray.hpp>
-
-using Arr = xt::xarray<double, xt::layout_type::row_major>;
 
 namespace lds
 {
 
-/**
- * @brief
- *
- */
-struct Sp3Table
-{
-    double _pi {xt::numeric_constants<double>::PI};
-    xt::xtensor<double, 1> x {xt::linspace(0., _pi, 300)};
-    xt::xtensor<double, 1> t {0.5 * (x - xt::sin(x) * xt::cos(x))};
-
-    /**
-     * @brief Construct a new Sp 3 Table object
-     *
-     */
-    // Sp3Table()
-    //     : _pi
-    //     , x
-    //     , t
-    // {
-    // }
-};
-
-
-auto getSp3() -> const Sp3Table&
-{
-    static auto sp3 = Sp3Table {};
-    return sp3;
-}
-
-static const auto halfPI = 0.5 * xt::numeric_constants<double>::PI;
-
-
-/**
- * @brief
- *
- * @return std::vector<double>
- */
-auto sphere3::operator()() -> std::vector<double>
-{
-    const auto ti = halfPI * this->_vdc(); // map to [0, pi/2];
-    const auto xi =
-        xt::interp(xt::xtensor<double, 1> {ti}, getSp3().t, getSp3().x);
-    const auto cosxi = std::cos(xi[0]);
-    const auto sinxi = std::sin(xi[0]);
-    const auto S = this->_sphere2();
-    return {sinxi * S[0], sinxi * S[1], sinxi * S[2], cosxi};
-}
-
-
-/**
- * @brief Construct a new cylin n::cylin n object
- *
- * @param n
- * @param base
- */
-cylin_n::cylin_n(gsl::span<const unsigned> base)
-    : _vdc(base[0])
-{
-    auto n = base.size();
-    assert(n >= 2);
-    if (n == 2)
-    {
-        this->_Cgen = std::make_unique<circle>(base[1]);
-    }
-    else
-    {
-        this->_Cgen = std::make_unique<cylin_n>(
-            base.last(n - 1)
-        );
-    }
-}
-
-/**
- * @brief
- *
- * @return std::vector<double>
- */
-auto cylin_n::operator()() -> std::vector<double>
-{
-    auto cosphi = 2 * this->_vdc() - 1; // map to [-1, 1];
-    const auto sinphi = std::sqrt(1 - cosphi * cosphi);
-    auto res = std::visit([](auto& t) { return (*t)(); }, this->_Cgen);
-    for (auto& xi : res)
-    {
-        xi *= sinphi;
-    }
-    res.emplace_back(std::move(cosphi));
-    return res;
-}
-
-
-/**
- * @brief
- *
- */
-class IntSinPowerTable
-{
-private:
-    using XT = xt::xtensor<double, 1>;
-    const double _pi {xt::numeric_constants<double>::PI};
-
-public:
-    const XT x {xt::linspace(0., _pi, 300)};
-
-private:
-    const XT _neg_cosine {-xt::cos(x)};
-    const XT _sine {xt::sin(x)};
-    std::vector<XT> _vec_tp_even;
-    std::vector<XT> _vec_tp_odd;
-
-public:
-    IntSinPowerTable()
-    {
-        this->_vec_tp_even.push_back(this->x);
-        this->_vec_tp_odd.push_back(this->_neg_cosine);
-    }
-
-    /** Evaluate integral sin^n(x) dx; */
-    auto get_tp(size_t n) -> const XT&
-    {
-        auto quot = n / 2;
-        auto rem = n % 2;
-        // auto [quot, rem] = std::div(int(n), 2);
-        return rem == 0 ? this->_get_tp_even(quot) : this->_get_tp_odd(quot);
-    }
-
-    auto _get_tp_even(size_t quot) -> const XT&
-    {
-        if (quot < this->_vec_tp_even.size())
-        {
-            return this->_vec_tp_even[quot];
-        }
-        const auto& Snm2 = this->_get_tp_even(quot - 1);
-        const auto n = 2. * double(quot);
-        auto res =
-            ((n - 1.) * Snm2 + this->_neg_cosine * xt::pow(this->_sine, n - 1.)) /
-            n;
-        this->_vec_tp_even.push_back(std::move(res));
-        return this->_vec_tp_even[quot];
-    }
-
-    auto _get_tp_odd(size_t quot) -> const XT&
-    {
-        if (quot < this->_vec_tp_odd.size())
-        {
-            return this->_vec_tp_odd[quot];
-        }
-        const auto& Snm2 = this->_get_tp_odd(quot - 1);
-        const auto n = 2. * double(quot) + 1.;
-        auto res =
-            ((n - 1.) * Snm2 + this->_neg_cosine * xt::pow(this->_sine, n - 1.)) /
-            n;
-        this->_vec_tp_odd.emplace_back(std::move(res));
-        return this->_vec_tp_odd[quot];
-    }
-};
-
-auto getSp() -> IntSinPowerTable&
-{
-    static auto sp = IntSinPowerTable {};
-    return sp;
-}
-
-// static IntSinPowerTable sp {};
-
-
-sphere_n::sphere_n(gsl::span<const unsigned> base)
-    : _vdc(base[0])
-    , _n (base.size())
-{
-    auto n = this->_n;
-    assert(n >= 3);
-    if (n == 3)
-    {
-        this->_Sgen = std::make_unique<sphere>(
-            base.subspan(1, 2));
-    }
-    else
-    {
-        this->_Sgen = std::make_unique<sphere_n>(
-            base.last(n - 1));
-    }
-
-    const auto m = 300; // number of interpolation points???;
-    const auto& tp = getSp().get_tp(n);
-    this->_t0 = tp[0];
-    this->_range_t = tp[m - 1] - tp[0];
-}
-
-auto sphere_n::operator()() -> std::vector<double>
-{
-    const auto vd = this->_vdc();
-    const auto ti = this->_t0 + this->_range_t * vd; // map to [t0, tm-1];
-    const auto xi = xt::interp(
-        xt::xtensor<double, 1> {ti}, getSp().get_tp(this->_n), getSp().x);
-    const auto sinphi = std::sin(xi[0]);
-    auto res = std::visit([](auto& t) { return (*t)(); }, this->_Sgen);
-    for (auto& _xi : res)
-    {
-        _xi *= sinphi;
-    }
-    res.emplace_back(std::cos(xi[0]));
-    return res;
-}
-
-
 // First 1000 prime numbers;
 const unsigned prime_table[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41,
     43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113,
@@ -0,0 +1,123 @@
+// libFuzzer target over bases, seeds and counts of the differential checks
+// in lds_diff.hpp. Build with -DBP_BUILD_FUZZERS=ON using Clang, then run
+// e.g. ./fuzz_lds -max_total_time=60
+
+#include "lds_diff.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric> // import gcd
+
+namespace
+{
+
+/**
+ * @brief Reads integers from the fuzzer input, zeros once it runs out
+ *
+ */
+class input
+{
+  private:
+    const std::uint8_t* _data;
+    size_t _size;
+
+  public:
+    input(const std::uint8_t* data, size_t size)
+        : _data {data}
+        , _size {size}
+    {
+    }
+
+    auto byte() -> unsigned
+    {
+        if (this->_size == 0)
+        {
+            return 0;
+        }
+        --this->_size;
+        return *this->_data++;
+    }
+
+    auto word() -> unsigned
+    {
+        auto w = 0U;
+        for (auto i = 0; i != 4; ++i)
+        {
+            w = (w << 8) | this->byte();
+        }
+        return w;
+    }
+};
+
+/**
+ * @brief Between lo and hi bases, each in [2, 2^16)
+ *
+ * @param in
+ * @param lo
+ * @param hi
+ * @return std::vector<unsigned>
+ */
+auto read_base(input& in, unsigned lo, unsigned hi) -> std::vector<unsigned>
+{
+    const auto n = lo + in.byte() % (hi - lo + 1);
+    auto base = std::vector<unsigned>(n);
+    for (auto& b : base)
+    {
+        b = 2 + (((in.byte() << 8) | in.byte()) % 65534);
+    }
+    return base;
+}
+
+auto check(bool ok) -> void
+{
+    if (!ok)
+    {
+        std::abort();
+    }
+}
+
+} // namespace
+
+extern "C" auto LLVMFuzzerTestOneInput(const std::uint8_t* data, size_t size)
+    -> int
+{
+    auto in = input(data, size);
+    const auto kind = in.byte() % 6;
+    const auto seed = in.word();
+    const auto count = 1 + in.byte();
+    switch (kind)
+    {
+        case 0:
+            check(lds_diff::check_vdcorput(
+                2 + in.word() % 65534, seed, count));
+            break;
+        case 1:
+        {
+            const auto base = read_base(in, 1, 8);
+            auto leap = 1 + in.byte();
+            for (auto&& b : base)
+            {
+                if (std::gcd(b, leap) != 1)
+                {
+                    leap = 1;
+                }
+            }
+            check(lds_diff::check_halton(base, leap, seed, count));
+            break;
+        }
+        case 2:
+            check(lds_diff::check_sphere_n(read_base(in, 3, 12), seed, count));
+            break;
+        case 3:
+            check(lds_diff::check_cylin_n(read_base(in, 2, 12), seed, count));
+            break;
+        case 4:
+            check(lds_diff::check_sphere(read_base(in, 3, 3), seed, count));
+            break;
+        default:
+            check(lds_diff::check_sobol(
+                1 + in.byte() % lds::sobol::max_dim(), seed, count));
+            break;
+    }
+    return 0;
+}
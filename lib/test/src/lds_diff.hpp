@@ -0,0 +1,433 @@
+#pragma once
+
+// Differential checks of the fast paths (fill, batch, streams, maps, arena,
+// skip-ahead) against the scalar reference generators, shared by the unit
+// tests and the libFuzzer target. Every check returns false on a mismatch.
+
+#include <lds/halton_stream.hpp>
+#include <lds/low_discr_seq.hpp>
+#include <lds/low_discr_seq_n.hpp>
+#include <lds/sfc_order.hpp>
+#include <lds/sobol.hpp>
+
+#include <algorithm> // import equal
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace lds_diff
+{
+
+/**
+ * @brief Distance between two doubles in units in the last place
+ *
+ * @param a
+ * @param b
+ * @return std::uint64_t
+ */
+inline auto ulp_distance(double a, double b) -> std::uint64_t
+{
+    if (a == b)
+    {
+        return 0; // also +0 == -0
+    }
+    if (std::isnan(a) || std::isnan(b))
+    {
+        return UINT64_MAX;
+    }
+    auto ordered = [](double x) {
+        auto i = std::int64_t {};
+        std::memcpy(&i, &x, sizeof x);
+        return i < 0 ? INT64_MIN - i : i;
+    };
+    const auto ia = ordered(a);
+    const auto ib = ordered(b);
+    return ia > ib ? std::uint64_t(ia) - std::uint64_t(ib)
+                   : std::uint64_t(ib) - std::uint64_t(ia);
+}
+
+/**
+ * @brief
+ *
+ * @param pt
+ * @param tol
+ * @return bool |pt| == 1 within tol
+ */
+inline auto unit_norm(const std::vector<double>& pt, double tol = 1e-12)
+    -> bool
+{
+    auto s = 0.;
+    for (auto&& x : pt)
+    {
+        s += x * x;
+    }
+    return std::abs(s - 1.) <= tol;
+}
+
+/**
+ * @brief Reference van der Corput: reversed digits over b^m, divided once
+ *
+ * Both are below 2^53 for 32-bit k, so the result is correctly rounded.
+ *
+ * @param k
+ * @param base
+ * @return double
+ */
+inline auto vdc_ref(unsigned k, unsigned base) -> double
+{
+    auto num = std::uint64_t {0};
+    auto den = std::uint64_t {1};
+    for (; k != 0; k /= base)
+    {
+        num = num * base + k % base;
+        den *= base;
+    }
+    return double(num) / double(den);
+}
+
+/** Tolerance of vdc against vdc_ref, from the rounding of its running sum */
+constexpr auto vdc_ulps = std::uint64_t {4};
+
+/**
+ * @brief vdcorput from seed vs vdc_ref; every value in [0, 1)
+ *
+ * @param base at least 2
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_vdcorput(unsigned base, unsigned seed, unsigned count)
+    -> bool
+{
+    auto gen = lds::vdcorput(base);
+    gen.reseed(seed);
+    for (auto i = 1U; i <= count; ++i)
+    {
+        const auto x = gen();
+        if (!(x >= 0. && x < 1.) ||
+            ulp_distance(x, vdc_ref(seed + i, base)) > vdc_ulps)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief halton_n::fill and the Halton stream families vs halton_n()/vdc
+ *
+ * @param base
+ * @param leap coprime to every base
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_halton(gsl::span<const unsigned> base, unsigned leap,
+    unsigned seed, unsigned count) -> bool
+{
+    auto ref = lds::halton_n(base);
+    auto fast = lds::halton_n(base);
+    ref.reseed(seed);
+    fast.reseed(seed);
+    const auto rgen = lds::halton_random_start(base);
+    auto rs = rgen.stream(seed);
+    auto pt = std::vector<double>(base.size());
+    for (auto i = 1U; i <= count; ++i)
+    {
+        const auto x = ref();
+        fast.fill(pt);
+        if (pt != x)
+        {
+            return false;
+        }
+        // Each dimension is vdc from its own start
+        const auto r = rgen(rs);
+        for (auto j = 0U; j != base.size(); ++j)
+        {
+            if (r[j] != lds::vdc64(rgen.start(rs, j) + i, base[j]))
+            {
+                return false;
+            }
+        }
+    }
+
+    // The first leap streams interleave to halton_n
+    const auto lgen = lds::halton_leaped(base, leap);
+    auto streams = std::vector<lds::halton_stream> {};
+    for (auto j = 0U; j != leap; ++j)
+    {
+        streams.push_back(lgen.stream(j));
+    }
+    ref.reseed(0);
+    for (auto i = 0U; i != count; ++i)
+    {
+        if (lgen(streams[i % leap]) != ref())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief fill, sphere_n_map and sphere_n_mapper vs sphere_n(); unit norm
+ *
+ * @param base at least 3 elements
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_sphere_n(gsl::span<const unsigned> base, unsigned seed,
+    unsigned count) -> bool
+{
+    auto ref = lds::sphere_n(base);
+    auto fast = lds::sphere_n(base);
+    auto cube = lds::halton_n(base);
+    auto buf = lds::arena<4096> {};
+    auto pooled = lds::sphere_n(base, buf.resource());
+    ref.reseed(seed);
+    fast.reseed(seed);
+    cube.reseed(seed);
+    pooled.reseed(seed);
+    auto pt = std::vector<double>(fast.size());
+    auto mapped = std::vector<double>(fast.size());
+    const auto mapper = lds::sphere_n_mapper(base.size());
+    for (auto i = 0U; i != count; ++i)
+    {
+        const auto x = ref();
+        const auto u = cube();
+        fast.fill(pt);
+        lds::sphere_n_map(u, mapped);
+        if (!unit_norm(x) || pt != x || pooled() != x ||
+            lds::sphere_n_map(u) != x || mapped != x)
+        {
+            return false;
+        }
+        mapper(u, mapped);
+        if (mapped != x)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief fill and cylin_n_map vs cylin_n(); unit norm
+ *
+ * @param base at least 2 elements
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_cylin_n(gsl::span<const unsigned> base, unsigned seed,
+    unsigned count) -> bool
+{
+    auto ref = lds::cylin_n(base);
+    auto fast = lds::cylin_n(base);
+    auto cube = lds::halton_n(base);
+    ref.reseed(seed);
+    fast.reseed(seed);
+    cube.reseed(seed);
+    auto pt = std::vector<double>(fast.size());
+    auto mapped = std::vector<double>(fast.size());
+    for (auto i = 0U; i != count; ++i)
+    {
+        const auto x = ref();
+        const auto u = cube();
+        fast.fill(pt);
+        lds::cylin_n_map(u, mapped);
+        if (!unit_norm(x) || pt != x || lds::cylin_n_map(u) != x ||
+            mapped != x)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief circle/sphere fill vs operator(); sphere3, sphere3_hopf unit norm
+ *
+ * @param base at least 3 elements
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_sphere(gsl::span<const unsigned> base, unsigned seed,
+    unsigned count) -> bool
+{
+    auto cref = lds::circle(base[0]);
+    auto cfast = lds::circle(base[0]);
+    auto sref = lds::sphere(base);
+    auto sfast = lds::sphere(base);
+    auto s3 = lds::sphere3(base);
+    auto hopf = lds::sphere3_hopf(base);
+    cref.reseed(seed);
+    cfast.reseed(seed);
+    sref.reseed(seed);
+    sfast.reseed(seed);
+    s3.reseed(seed);
+    hopf.reseed(seed);
+    auto c = std::vector<double>(2);
+    auto s = std::vector<double>(3);
+    for (auto i = 0U; i != count; ++i)
+    {
+        cfast.fill(c);
+        sfast.fill(s);
+        const auto x = sref();
+        if (c != cref() || s != x || !unit_norm(x) || !unit_norm(s3()) ||
+            !unit_norm(hopf()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gray-code stepping and batch vs skip-ahead; values in [0, 1)
+ *
+ * @param dim 1..sobol::max_dim()
+ * @param seed
+ * @param count
+ * @return bool
+ */
+inline auto check_sobol(size_t dim, unsigned seed, unsigned count) -> bool
+{
+    auto step = lds::sobol(dim);
+    auto jump = lds::sobol(dim);
+    auto bat = lds::sobol(dim);
+    step.reseed(seed);
+    bat.reseed(seed);
+    auto block = std::vector<double>(dim * count);
+    bat.batch(block);
+    for (auto i = 0U; i != count; ++i)
+    {
+        jump.reseed(seed + i);
+        const auto x = step();
+        const auto first = block.begin() + std::ptrdiff_t(i * dim);
+        if (jump() != x || !std::equal(x.begin(), x.end(), first))
+        {
+            return false;
+        }
+        for (auto&& xj : x)
+        {
+            if (!(xj >= 0. && xj < 1.))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief hilbert_order/morton_order return permutations; reorder is exact
+ *
+ * @param pts row-major batch
+ * @param dim
+ * @param lo
+ * @return bool
+ */
+inline auto check_sfc_order(gsl::span<const double> pts, size_t dim,
+    double lo) -> bool
+{
+    const auto npts = pts.size() / dim;
+    for (auto&& perm :
+        {lds::hilbert_order(pts, dim, lo), lds::morton_order(pts, dim, lo)})
+    {
+        if (perm.size() != npts)
+        {
+            return false;
+        }
+        auto seen = std::vector<bool>(npts);
+        for (auto&& p : perm)
+        {
+            if (p >= npts || seen[p])
+            {
+                return false;
+            }
+            seen[p] = true;
+        }
+        const auto res = lds::sfc_reorder(pts, dim, perm);
+        for (auto i = size_t {0}; i != npts; ++i)
+        {
+            for (auto j = size_t {0}; j != dim; ++j)
+            {
+                if (res[i * dim + j] != pts[perm[i] * dim + j])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief Successive points in hilbert_order are neighbouring grid cells
+ *
+ * The points are the cell centres of a shuffled 2^k grid in dim dimensions;
+ * along the Hilbert curve each step moves by one cell in L1 distance.
+ *
+ * @param dim
+ * @param k bits per coordinate, at most min(21, 64 / dim)
+ * @param shuffle seed of the point order
+ * @return bool
+ */
+inline auto check_hilbert_adjacent(size_t dim, unsigned k, unsigned shuffle)
+    -> bool
+{
+    const auto side = size_t(1) << k;
+    auto npts = size_t {1};
+    for (auto j = size_t {0}; j != dim; ++j)
+    {
+        npts *= side;
+    }
+    auto cells = std::vector<size_t>(npts);
+    for (auto i = size_t {0}; i != npts; ++i)
+    {
+        cells[i] = i;
+    }
+    auto rng = std::mt19937 {shuffle};
+    std::shuffle(cells.begin(), cells.end(), rng);
+    // cell number -> coordinates, digit j in base side
+    auto coord = [&](size_t c, size_t j) {
+        for (auto i = size_t {0}; i != j; ++i)
+        {
+            c /= side;
+        }
+        return c % side;
+    };
+    auto pts = std::vector<double>(npts * dim);
+    for (auto i = size_t {0}; i != npts; ++i)
+    {
+        for (auto j = size_t {0}; j != dim; ++j)
+        {
+            pts[i * dim + j] =
+                (double(coord(cells[i], j)) + 0.5) / double(side);
+        }
+    }
+    const auto perm = lds::hilbert_order(pts, dim);
+    for (auto i = size_t {1}; i != npts; ++i)
+    {
+        auto dist = size_t {0};
+        for (auto j = size_t {0}; j != dim; ++j)
+        {
+            const auto a = coord(cells[perm[i - 1]], j);
+            const auto b = coord(cells[perm[i]], j);
+            dist += a > b ? a - b : b - a;
+        }
+        if (dist != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace lds_diff
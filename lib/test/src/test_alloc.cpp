@@ -0,0 +1,110 @@
+#include <cstdlib>
+#include <doctest.h>
+#include <lds/arena.hpp>
+#include <lds/low_discr_seq.hpp>
+#include <lds/low_discr_seq_n.hpp>
+#include <new>
+
+// Count the calls of the global operator new, so that tests can check that
+// a code path does not touch the global heap.
+
+static auto global_news = std::size_t {0};
+
+auto operator new(std::size_t size) -> void*
+{
+    global_news += 1;
+    if (auto* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc {};
+}
+
+auto operator delete(void* p) noexcept -> void
+{
+    std::free(p);
+}
+
+auto operator delete(void* p, std::size_t) noexcept -> void
+{
+    std::free(p);
+}
+
+TEST_CASE("generators built from an arena do not touch the global heap")
+{
+    lds::init_tables();
+    const unsigned b[] = {2, 3, 5, 7, 11, 13, 17};
+    auto buf = lds::arena<8192> {std::pmr::null_memory_resource()};
+
+    const auto before = global_news;
+    auto hgen = lds::halton_n(b, buf.resource());
+    auto cgen = lds::cylin_n(b, buf.resource());
+    auto sgen = lds::sphere_n(b, buf.resource());
+    CHECK(global_news == before);
+
+    double pt[8];
+    hgen.fill(pt);
+    cgen.fill(pt);
+    sgen.fill(pt);
+    CHECK(global_news == before);
+}
+
+/**
+ * @brief Generators in a std::pmr::vector live in its arena
+ *
+ * Reallocation moves them with the vector's allocator; a generator from the
+ * default resource is moved in by rebuilding it in the arena, keeping its
+ * state.
+ *
+ * @tparam Gen halton_n, cylin_n or sphere_n
+ * @param base
+ * @return bool
+ */
+template <typename Gen>
+static auto check_pmr_vector(gsl::span<const unsigned> base) -> bool
+{
+    auto buf = lds::arena<16384> {std::pmr::null_memory_resource()};
+    auto vec = std::pmr::vector<Gen>(buf.resource());
+    for (auto i = 0; i != 5; ++i)
+    {
+        vec.emplace_back(base);
+    }
+    auto other = Gen(base);
+    other();
+    const auto before = global_news;
+    vec.push_back(std::move(other));
+    if (global_news != before)
+    {
+        return false;
+    }
+    auto ref = Gen(base);
+    if (vec.front()() != ref())
+    {
+        return false;
+    }
+    for (auto i = 0; i != 3; ++i)
+    {
+        if (vec.back()() != ref())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("generators in a std::pmr::vector")
+{
+    const unsigned b[] = {2, 3, 5, 7, 11};
+    lds::init_tables();
+    CHECK(check_pmr_vector<lds::halton_n>(b));
+    CHECK(check_pmr_vector<lds::cylin_n>(b));
+    CHECK(check_pmr_vector<lds::sphere_n>(b));
+
+    // halton_n is also copyable into the arena
+    auto buf = lds::arena<4096> {std::pmr::null_memory_resource()};
+    auto vec = std::pmr::vector<lds::halton_n>(buf.resource());
+    vec.reserve(2);
+    vec.emplace_back(b);
+    vec.push_back(vec.front());
+    CHECK(vec.back()() == lds::halton_n(b)());
+}
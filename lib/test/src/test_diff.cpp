@@ -0,0 +1,296 @@
+#include "lds_diff.hpp"
+#include <doctest.h>
+#include <limits>
+#include <random>
+
+// Property-style differential tests: the fast paths against the scalar
+// generators, over fixed pseudo-random bases, seeds and counts.
+
+static const unsigned primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37,
+    41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97};
+
+/**
+ * @brief n distinct bases drawn from primes
+ *
+ * @param rng
+ * @param n
+ * @return std::vector<unsigned>
+ */
+static auto random_base(std::mt19937& rng, size_t n) -> std::vector<unsigned>
+{
+    auto base = std::vector<unsigned>(std::begin(primes), std::end(primes));
+    std::shuffle(base.begin(), base.end(), rng);
+    base.resize(n);
+    return base;
+}
+
+static auto random_seed(std::mt19937& rng) -> unsigned
+{
+    return std::uniform_int_distribution<unsigned> {0, 1U << 24}(rng);
+}
+
+TEST_CASE("vdc within vdc_ulps of the correctly rounded value")
+{
+    auto rng = std::mt19937 {1};
+    for (auto base = 2U; base != 100; ++base)
+    {
+        CHECK(lds_diff::check_vdcorput(base, 0, 1000));
+        CHECK(lds_diff::check_vdcorput(base, random_seed(rng), 100));
+        CHECK(lds_diff::check_vdcorput(base, 0xFFFFFF00U, 200));
+    }
+}
+
+TEST_CASE("halton_n fill and stream families")
+{
+    auto rng = std::mt19937 {2};
+    for (auto n = 1U; n != 8; ++n)
+    {
+        auto base = random_base(rng, n);
+        // 101 is coprime to every base drawn above
+        CHECK(lds_diff::check_halton(base, 101, random_seed(rng), 500));
+        CHECK(lds_diff::check_halton(base, 1, 0, 100));
+    }
+}
+
+TEST_CASE("halton_leaped index does not wrap past 2^32 with a large leap")
+{
+    const unsigned base[] = {2, 3, 5, 7};
+    const auto leap = 100003U; // prime, one stream per replica
+    const auto gen = lds::halton_leaped(base, leap);
+    auto s = gen.stream(leap - 1);
+    auto pt = std::vector<double>(4);
+    for (auto k = 0; k != 50000; ++k) // 50000 * leap > 2^32
+    {
+        gen.next(s, pt);
+    }
+    const auto x = gen(s);
+    const auto idx = std::uint64_t {50000} * leap + leap;
+    for (auto i = 0U; i != 4; ++i)
+    {
+        CHECK(x[i] == lds::vdc64(idx, base[i]));
+    }
+}
+
+TEST_CASE("sphere_n, cylin_n fill, maps and arena; unit norm")
+{
+    auto rng = std::mt19937 {3};
+    for (auto n = 3U; n != 12; ++n)
+    {
+        auto base = random_base(rng, n);
+        CHECK(lds_diff::check_sphere_n(base, random_seed(rng), 200));
+        CHECK(lds_diff::check_cylin_n(base, random_seed(rng), 200));
+    }
+    CHECK(lds_diff::check_cylin_n(random_base(rng, 2), 0, 200));
+    // above IntSinPowerTable::prebuilt_n, where the tables grow on demand
+    const auto many = gsl::span<const unsigned>(lds::prime_table).first(70);
+    CHECK(lds_diff::check_sphere_n(many, random_seed(rng), 20));
+}
+
+// First ten points of the baseline (xtensor) sphere3({2, 3, 5}),
+// sphere_n({2, 3, 5, 7}) and cylin_n({2, 3, 5, 7}), from the baseline
+// formulas with xt::linspace as start + i * step and xt::interp as
+// numpy.interp, printed with round-trip precision.
+static const double golden_sphere3[][4] = {
+    {0.8966646826186098, 0.2913440162992141, -0.33333333333333337,
+        6.123233995736766e-17},
+    {0.5069371683663506, -0.697739153354296, 0.30492319090118075,
+        0.4039760251002259},
+    {-0.33795811224423367, -0.4651594355695309, -0.7114874454360887,
+        -0.4039760251002258},
+    {-0.7303800100566173, 0.23731485100218302, -0.08586131969610163,
+        0.634708229175856},
+    {0.20270132011818542, 0.7894695182151528, 0.544595994329299,
+        -0.19764932985457223},
+    {0.8134682824136722, 0.051179086309454114, -0.5445959943292992,
+        0.19764932985457237},
+    {0.2827075046384319, -0.7140376491597653, 0.08586131969610163,
+        -0.6347082291758559},
+    {-0.30699987732880385, -0.2539723859311107, 0.49303885423959726,
+        0.7734092000452695},
+    {-0.3173613919107008, 0.2014036636020021, -0.9214383378738055,
+        -0.09833463636253847},
+    {0.443988803653532, 0.8076126357141739, -0.24739479977418324,
+        0.29905114263249766},
+};
+static const double golden_sphere_n[][5] = {
+    {0.6092711237422036, 0.48587750779888567, -0.5844652627241038,
+        0.22607985725822774, 6.123233995736766e-17},
+    {0.8849346776396531, -0.20198056543280166, -0.18528193972314985,
+        -0.21500943079098303, 0.30908900818633717},
+    {0.32778893848522306, -0.6806607443242988, 0.1542109806208929,
+        0.5567210445249497, -0.3090890081863373},
+    {-0.2991910359947545, -0.6212765879057519, 0.5171737421006875,
+        0.06414550210081837, 0.5029083418898294},
+    {-0.3478837840086332, -0.07940220354612298, -0.8376332346016966,
+        -0.3858333054117045, -0.14891402761873138},
+    {-0.6080252852851544, 0.48488398478254235, -0.4734448717313937,
+        0.38583330541170463, 0.1489140276187315},
+    {0.10942802276275598, 0.848702135540705, -0.10343474842013747,
+        -0.06414550210081846, -0.5029083418898295},
+    {0.5138384880247662, 0.3114919110907453, 0.17525677055432973,
+        -0.4519278531372947, 0.635601351070811},
+    {0.4389222717405608, -0.16152745335352903, 0.433757739666254,
+        0.7665889126146067, -0.07383619382935343},
+    {0.1639643909425458, -0.49383462134098416, -0.8055642669855151,
+        0.17007344134332905, 0.2266810128210426},
+};
+static const double golden_cylin_n[][5] = {
+    {0.5896942325314937, 0.4702654580212986, -0.565685424949238,
+        -0.33333333333333337, 0.0},
+    {0.7799423297454589, -0.17801674716505145, -0.16329931618554513,
+        0.2886751345948128, -0.5},
+    {0.2314046608626977, -0.4805167295479567, 0.10886621079036342,
+        -0.6735753140545634, 0.5},
+    {-0.2281680726408047, -0.47379588485330215, 0.39440531887330776,
+        -0.07349309197401645, -0.75},
+    {-0.30761340326604825, -0.07021075193042121, -0.7406703670274604,
+        0.5379143536399188, 0.25},
+    {-0.5376414074929536, 0.42875471523691105, -0.4186397726676949,
+        -0.537914353639919, -0.25},
+    {0.08345163471779245, 0.6472343994819842, -0.07888106377466154,
+        0.07349309197401645, 0.75},
+    {0.2498031899655053, 0.15143216176357996, 0.08520128672302588,
+        0.3765400475479433, -0.875},
+    {0.25785911461779826, -0.09489453780287567, 0.2548250428610497,
+        -0.9186636496752051, 0.125},
+    {0.1530772608880413, -0.46104432024542363, -0.7520753180038667,
+        -0.24033976578550764, -0.375},
+};
+
+// A different rounding of the interpolation moves a coordinate by a few ULP,
+// or by about DBL_EPSILON where it is close to zero
+constexpr auto golden_ulps = std::uint64_t {8};
+constexpr auto golden_abs = std::numeric_limits<double>::epsilon();
+
+template <typename Gen, size_t N, size_t Dim>
+static auto matches_golden(Gen&& gen, const double (&golden)[N][Dim]) -> bool
+{
+    for (auto i = size_t {0}; i != N; ++i)
+    {
+        const auto x = gen();
+        if (x.size() != Dim)
+        {
+            return false;
+        }
+        for (auto j = size_t {0}; j != Dim; ++j)
+        {
+            if (lds_diff::ulp_distance(x[j], golden[i][j]) > golden_ulps &&
+                std::abs(x[j] - golden[i][j]) > golden_abs)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+TEST_CASE("sphere3, sphere_n, cylin_n match the baseline golden points")
+{
+    const unsigned base[] = {2, 3, 5, 7};
+    CHECK(matches_golden(lds::sphere3(base), golden_sphere3));
+    CHECK(matches_golden(lds::sphere_n(base), golden_sphere_n));
+    CHECK(matches_golden(lds::cylin_n(base), golden_cylin_n));
+
+    // fill and the pooled chain follow the same path
+    auto buf = lds::arena<4096> {};
+    auto pooled = lds::sphere_n(base, buf.resource());
+    auto fast = lds::sphere_n(base);
+    auto pt = std::vector<double>(fast.size());
+    CHECK(matches_golden(pooled, golden_sphere_n));
+    CHECK(matches_golden(
+              [&]() {
+                  fast.fill(pt);
+                  return pt;
+              },
+              golden_sphere_n));
+}
+
+TEST_CASE("circle, sphere fill; sphere3 and sphere3_hopf unit norm")
+{
+    auto rng = std::mt19937 {4};
+    for (auto i = 0; i != 10; ++i)
+    {
+        const auto base = random_base(rng, 3);
+        CHECK(lds_diff::check_sphere(base, random_seed(rng), 200));
+    }
+}
+
+TEST_CASE("sobol Gray-code stepping and batch vs skip-ahead")
+{
+    auto rng = std::mt19937 {5};
+    for (auto dim = size_t {1}; dim <= lds::sobol::max_dim(); ++dim)
+    {
+        CHECK(lds_diff::check_sobol(dim, 0, 300));
+        CHECK(lds_diff::check_sobol(dim, random_seed(rng), 100));
+    }
+}
+
+TEST_CASE("sobol stepping across the 2^32 seed boundary")
+{
+    // The index wraps with the 2^32 period; stepping, batch and skip-ahead
+    // must agree on both sides of it
+    for (auto dim : {size_t {1}, size_t {2}, size_t {7}, lds::sobol::max_dim()})
+    {
+        CHECK(lds_diff::check_sobol(dim, 0xFFFFFF00U, 512));
+        CHECK(lds_diff::check_sobol(dim, 0xFFFFFFFFU, 16));
+    }
+    // Point 2^32 is point 0, the origin
+    auto gen = lds::sobol(3);
+    gen.reseed(0xFFFFFFFFU);
+    CHECK(gen() == std::vector<double>(3, 0.));
+}
+
+TEST_CASE("sobol first 2^m points stratify every dimension")
+{
+    auto gen = lds::sobol(lds::sobol::max_dim());
+    auto hits = std::vector<int>(gen.size() << 10);
+    for (auto j = size_t {0}; j != gen.size(); ++j)
+    {
+        hits[j << 10] += 1; // index 0 is the origin
+    }
+    for (auto i = 1; i != 1024; ++i)
+    {
+        const auto x = gen();
+        for (auto j = size_t {0}; j != x.size(); ++j)
+        {
+            hits[(j << 10) + size_t(x[j] * 1024)] += 1;
+        }
+    }
+    CHECK(std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }));
+}
+
+TEST_CASE("hilbert_order and morton_order are permutations")
+{
+    const unsigned b[] = {2, 3, 5, 7};
+    auto hgen = lds::halton_n(b);
+    auto sgen = lds::sphere(b);
+    auto cube = std::vector<double>(4 * 1000);
+    auto ball = std::vector<double>(3 * 1000);
+    for (auto i = size_t {0}; i != 1000; ++i)
+    {
+        hgen.fill(gsl::span<double>(cube).subspan(4 * i, 4));
+        sgen.fill(gsl::span<double>(ball).subspan(3 * i, 3));
+    }
+    CHECK(lds_diff::check_sfc_order(cube, 4, 0.));
+    CHECK(lds_diff::check_sfc_order(ball, 3, -1.));
+}
+
+TEST_CASE("hilbert_order steps between neighbouring cells of a 2^k grid")
+{
+    CHECK(lds_diff::check_hilbert_adjacent(2, 3, 1));
+    CHECK(lds_diff::check_hilbert_adjacent(2, 5, 2));
+    CHECK(lds_diff::check_hilbert_adjacent(3, 3, 3));
+    CHECK(lds_diff::check_hilbert_adjacent(4, 3, 4));
+}
+
+TEST_CASE("morton_key interleaves bits, most significant of q[0] first")
+{
+    std::uint32_t q2[] = {0b101, 0b011};
+    CHECK(lds::morton_key(q2, 3) == 0b10'01'11);
+    std::uint32_t q3[] = {0b001, 0b010, 0b100};
+    CHECK(lds::morton_key(q3, 3) == 0b001'010'100);
+    std::uint32_t q4[] = {0b11, 0b00, 0b10, 0b01};
+    CHECK(lds::morton_key(q4, 2) == 0b1010'1001);
+    std::uint32_t one[] = {0x1FFFFF};
+    CHECK(lds::morton_key(one, 21) == 0x1FFFFF);
+}
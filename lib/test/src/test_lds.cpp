@@ -1,6 +1,11 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest.h>
 #include <fmt/ranges.h>
+#include <lds/halton_stream.hpp>
 #include <lds/low_discr_seq.hpp>
 #include <lds/low_discr_seq_n.hpp>
+#include <lds/sfc_order.hpp>
+#include <lds/sobol.hpp>
 
 template <typename T>
 void print_test(T&& gen)
@@ -11,7 +16,7 @@ void print_test(T&& gen)
     }
 }
 
-auto main() -> int
+TEST_CASE("print ten points of each generator")
 {
     const unsigned b[] = {2, 3, 5, 7, 11};
 
@@ -24,4 +29,29 @@ auto main() -> int
     print_test(lds::cylin_n({b, 3}));
     print_test(lds::sphere_n({b, 3}));
     print_test(lds::sphere_n({b, 4}));
+
+    const auto lgen = lds::halton_leaped({b, 2}, 7);
+    auto ls = lgen.stream(3);
+    print_test([&]() { return lgen(ls); });
+
+    const auto rgen = lds::halton_random_start({b, 2});
+    auto rs = rgen.stream(1000);
+    print_test([&]() { return rgen(rs); });
+
+    print_test(lds::sobol(3));
+    auto sgen = lds::sobol(4);
+    print_test([&]() { return lds::sphere_n_map(sgen()); });
+
+    auto buf = lds::arena<4096> {std::pmr::null_memory_resource()};
+    print_test(lds::sphere_n({b, 5}, buf.resource()));
+    print_test(lds::cylin_n({b, 5}, buf.resource()));
+
+    auto hgen = lds::halton_n({b, 2});
+    auto pts = std::vector<double>(20);
+    for (auto i = 0U; i != 10; ++i)
+    {
+        hgen.fill(gsl::span<double>(pts).subspan(2 * i, 2));
+    }
+    fmt::print("{}\n", lds::hilbert_order(pts, 2));
+    fmt::print("{}\n", lds::morton_order(pts, 2));
 }
@@ -0,0 +1,27 @@
+#include <doctest.h>
+#include <lds/low_discr_seq_n.hpp>
+#include <lds/sobol.hpp>
+#include <lds/xtensor_adapter.hpp>
+
+// Built only when xtensor is found (see lib/test/CMakeLists.txt).
+
+TEST_CASE("xtensor views alias the generator output")
+{
+    unsigned base[] = {2, 3, 5, 7};
+    auto sgen = lds::sphere_n(base);
+    auto pt = sgen();
+    auto v = lds::as_xtensor(pt);
+    CHECK(v.shape()[0] == 5);
+    v(0) = 42.;
+    CHECK(pt[0] == 42.);
+
+    auto qgen = lds::sobol(3);
+    auto buf = std::vector<double>(3 * 8);
+    qgen.batch(buf);
+    auto m = lds::as_xtensor(buf, 3);
+    CHECK(m.shape()[0] == 8);
+    CHECK(m.shape()[1] == 3);
+    CHECK(m(5, 2) == buf[5 * 3 + 2]);
+    m(7, 1) = -1.;
+    CHECK(buf[7 * 3 + 1] == -1.);
+}